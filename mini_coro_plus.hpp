@@ -54,6 +54,7 @@
 #include <any>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -85,6 +86,11 @@ namespace mcp
       return ( st == state::STARTING ) || ( st == state::SLEEPING ) || ( st == state::COMPLETED );
    }
 
+   [[nodiscard]] constexpr bool can_reset( const state st ) noexcept
+   {
+      return ( st == state::STARTING ) || ( st == state::COMPLETED );
+   }
+
    [[nodiscard]] constexpr bool can_resume( const state st ) noexcept
    {
       return ( st == state::STARTING ) || ( st == state::SLEEPING );
@@ -172,6 +178,15 @@ namespace mcp
       internal::implementation* m_impl;
    };
 
+   // Result of coroutine::try_resume(); the value refers to the coroutine's most recently yielded value.
+
+   struct resume_result
+   {
+      mcp::state state;
+      std::any& value;
+      std::exception_ptr exception;
+   };
+
    class coroutine
    {
    public:
@@ -187,6 +202,10 @@ namespace mcp
 
       void abort();
       void clear();
+      void reset( std::function< void() >&& );  // Re-uses the stack etc. without allocation unless the signature differs from the current one.
+      void reset( const std::function< void() >& );
+      void reset( std::function< void( control& ) >&& );
+      void reset( const std::function< void( control& ) >& );
       void resume();
       void resume( std::any&& any );
       void resume( const std::any& any );
@@ -195,6 +214,10 @@ namespace mcp
       [[nodiscard]] std::any& resume_any( std::any&& any );
       [[nodiscard]] std::any& resume_any( const std::any& any );
 
+      [[nodiscard]] resume_result try_resume() noexcept;  // Like resume_any() but never throws.
+      [[nodiscard]] resume_result try_resume( std::any&& any ) noexcept;
+      [[nodiscard]] resume_result try_resume( const std::any& any ) noexcept;
+
       template< typename... Ts >
       void resume( Ts&&... ts )
       {
@@ -207,6 +230,17 @@ namespace mcp
          return resume_any( std::any( std::forward< Ts >( ts )... ) );
       }
 
+      template< typename... Ts >
+      [[nodiscard]] resume_result try_resume( Ts&&... ts ) noexcept
+      {
+         try {
+            return try_resume( std::any( std::forward< Ts >( ts )... ) );
+         }
+         catch( ... ) {
+            return try_resume_failed();
+         }
+      }
+
       template< typename T, typename... As >
       [[nodiscard]] T resume_as( As&&... as )
       {
@@ -231,6 +265,8 @@ namespace mcp
 
    protected:
       std::shared_ptr< internal::implementation > m_impl;
+
+      [[nodiscard]] resume_result try_resume_failed() noexcept;  // Must be called from within a catch block.
    };
 
 }  // namespace mcp
@@ -274,6 +274,12 @@ __asm__(
 
       struct terminator {};
 
+      enum class function_kind : std::uint8_t
+      {
+         PLAIN,   // Holds a std::function< void() >.
+         CONTROL  // Holds a std::function< void( control& ) >.
+      };
+
       inline constexpr std::size_t align_quantum = 16;
       inline constexpr std::size_t min_stack_size = 1024 * 2;
       inline constexpr std::size_t default_stack_size = 1024 * 42;
@@ -309,6 +315,19 @@ __asm__(
       static_assert( align_forward( min_stack_size, align_quantum ) == min_stack_size );
       static_assert( align_forward( default_stack_size, align_quantum ) == default_stack_size );
 
+      [[nodiscard]] const std::exception_ptr& invalid_resume() noexcept
+      {
+         static const std::exception_ptr ptr = std::make_exception_ptr( std::logic_error( "Invalid state for coroutine resume!" ) );
+         return ptr;
+      }
+
+      [[nodiscard]] std::any& empty_any() noexcept
+      {
+         thread_local std::any any;
+         any.reset();
+         return any;
+      }
+
       template< typename Coroutine >
       void try_catch_main( Coroutine* co )
       {
@@ -404,6 +423,22 @@ __asm__(
             m_exception = std::move( ptr );
          }
 
+         [[nodiscard]] function_kind kind() const noexcept
+         {
+            return m_kind;
+         }
+
+         void reset()
+         {
+            if( !can_reset( m_state ) ) {
+               throw std::logic_error( "Invalid state for coroutine reset!" );
+            }
+            m_xfer_r2y.reset();
+            m_xfer_y2r.reset();
+            m_exception = std::exception_ptr();
+            m_state = state::STARTING;
+         }
+
          void abort()
          {
             if( nop_abort( m_state ) ){
@@ -435,6 +470,16 @@ __asm__(
             }
          }
 
+         [[nodiscard]] std::exception_ptr try_resume() noexcept
+         {
+            if( !can_resume( m_state ) ) {
+               return invalid_resume();
+            }
+            assert( !m_exception );
+            resume_impl();
+            return std::exchange( m_exception, std::exception_ptr() );
+         }
+
          void yield( const mcp::state st )
          {
             if( running_coroutine.load() != this ) {
@@ -456,13 +501,15 @@ __asm__(
          std::any m_xfer_y2r;
          std::exception_ptr m_exception;
          mcp::state m_state = state::STARTING;
+         const function_kind m_kind;
          double_context m_contexts;
          implementation* m_previous = nullptr;  // Where to yield back to (intrusive linked list).
          void* const m_stack_base;
          const std::size_t m_stack_size;
 
-         implementation( void* stack_base, const std::size_t stack_size ) noexcept
-            : m_stack_base( stack_base ),
+         implementation( const function_kind kind, void* stack_base, const std::size_t stack_size ) noexcept
+            : m_kind( kind ),
+              m_stack_base( stack_base ),
               m_stack_size( stack_size )
          {}
 
@@ -500,8 +547,21 @@ __asm__(
          : public implementation
       {
       protected:
-         initialization( void* stack_base, const std::size_t stack_size ) noexcept
-            : implementation( stack_base, stack_size )
+         initialization( const function_kind kind, void* stack_base, const std::size_t stack_size ) noexcept
+            : implementation( kind, stack_base, stack_size )
+         {
+            init_contexts();
+         }
+
+         void reset()
+         {
+            implementation::reset();
+            m_contexts = double_context();
+            init_contexts();
+         }
+
+      private:
+         void init_contexts() noexcept
          {
             init_context( this, reinterpret_cast< void* >( &try_catch_main< Coroutine > ), m_contexts.this_ctx, m_stack_base, m_stack_size );
          }
@@ -518,7 +578,7 @@ __asm__(
          using function_t = void();
 
          coroutine( std::function< function_t > function, void* stack_base, const std::size_t stack_size ) noexcept
-            : initialization< coroutine< function_t > >( stack_base, stack_size ),
+            : initialization< coroutine< function_t > >( function_kind::PLAIN, stack_base, stack_size ),
               m_function( std::move( function ) )
          {}
 
@@ -527,6 +587,20 @@ __asm__(
             m_function();
          }
 
+         void reset( std::function< function_t >&& function )
+         {
+            initialization< coroutine< function_t > >::reset();
+            std::function< function_t >( std::move( function ) ).swap( m_function );  // The old function is destroyed here and not handed back to the caller.
+         }
+
+         void reset( std::function< void( control& ) >&& function )
+         {
+            reset( std::function< function_t >( [ f = std::move( function ) ]() {
+               control c;
+               f( c );
+            } ) );
+         }
+
       private:
          std::function< function_t > m_function;
       };
@@ -539,7 +613,7 @@ __asm__(
          using function_t = void( control& );
 
          coroutine( std::function< function_t > function, void* stack_base, const std::size_t stack_size ) noexcept
-            : initialization< coroutine< function_t > >( stack_base, stack_size ),
+            : initialization< coroutine< function_t > >( function_kind::CONTROL, stack_base, stack_size ),
               m_function( std::move( function ) )
          {}
 
@@ -549,10 +623,38 @@ __asm__(
             m_function( c );
          }
 
+         void reset( std::function< function_t >&& function )
+         {
+            initialization< coroutine< function_t > >::reset();
+            std::function< function_t >( std::move( function ) ).swap( m_function );  // The old function is destroyed here and not handed back to the caller.
+         }
+
+         void reset( std::function< void() >&& function )
+         {
+            reset( std::function< function_t >( [ f = std::move( function ) ]( control& ) {
+               f();
+            } ) );
+         }
+
       private:
          std::function< function_t > m_function;
       };
 
+      template< typename F >
+      void reset( implementation& impl, std::function< F >&& function )
+      {
+         switch( impl.kind() ) {
+            case function_kind::PLAIN:
+               static_cast< coroutine< void() >& >( impl ).reset( std::move( function ) );
+               return;
+            case function_kind::CONTROL:
+               static_cast< coroutine< void( control& ) >& >( impl ).reset( std::move( function ) );
+               return;
+         }
+         assert( !bool( "Invalid coroutine function kind!" ) );
+         std::terminate();
+      }
+
       template< typename F >
       [[nodiscard]] static std::shared_ptr< implementation > make_shared( std::function< F > function, const std::size_t requested )
       {
@@ -685,6 +787,26 @@ __asm__(
       std::shared_ptr< internal::implementation >( std::move( m_impl ) )->abort();
    }
 
+   void coroutine::reset( std::function< void() >&& f )
+   {
+      internal::reset( *m_impl, std::move( f ) );
+   }
+
+   void coroutine::reset( const std::function< void() >& f )
+   {
+      reset( std::function< void() >( f ) );
+   }
+
+   void coroutine::reset( std::function< void( control& ) >&& f )
+   {
+      internal::reset( *m_impl, std::move( f ) );
+   }
+
+   void coroutine::reset( const std::function< void( control& ) >& f )
+   {
+      reset( std::function< void( control& ) >( f ) );
+   }
+
    void coroutine::resume()
    {
       m_impl->set_xfer_r2y();
@@ -720,6 +842,39 @@ __asm__(
       return m_impl->xfer_y2r();
    }
 
+   resume_result coroutine::try_resume() noexcept
+   {
+      return try_resume( std::any() );
+   }
+
+   resume_result coroutine::try_resume( std::any&& any ) noexcept
+   {
+      if( !m_impl ) {
+         return { state::COMPLETED, internal::empty_any(), internal::invalid_resume() };
+      }
+      m_impl->set_xfer_r2y( std::move( any ) );
+      std::exception_ptr e = m_impl->try_resume();
+      return { m_impl->state(), m_impl->xfer_y2r(), std::move( e ) };
+   }
+
+   resume_result coroutine::try_resume( const std::any& any ) noexcept
+   {
+      try {
+         return try_resume( std::any( any ) );
+      }
+      catch( ... ) {
+         return try_resume_failed();
+      }
+   }
+
+   resume_result coroutine::try_resume_failed() noexcept
+   {
+      if( !m_impl ) {
+         return { state::COMPLETED, internal::empty_any(), std::current_exception() };
+      }
+      return { m_impl->state(), m_impl->xfer_y2r(), std::current_exception() };
+   }
+
    // TODO: A function to obtain how much stack is currently used in a running coroutine?
 
 }  // namespace mcp
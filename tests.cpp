@@ -226,6 +226,151 @@ namespace mcp::test
          coro.abort();
          MCP_TEST_ASSERT( c == 2 );
          MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+      } {
+         std::size_t c = 0;
+         coroutine coro( [ & ](){
+            ++c;
+         } );
+         const std::size_t size = coro.stack_size();
+         coro.resume();
+         MCP_TEST_ASSERT( c == 1 );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+         coro.reset( [ & ](){
+            c += 10;
+            control().yield( 42 );
+            c += 100;
+         } );
+         MCP_TEST_ASSERT( coro.state() == state::STARTING );
+         MCP_TEST_ASSERT( coro.stack_size() == size );
+         MCP_TEST_ASSERT( c == 1 );
+         MCP_TEST_ASSERT( coro.resume_as< int >() == 42 );
+         MCP_TEST_ASSERT( c == 11 );
+         MCP_TEST_THROWS( coro.reset( [](){} ) );
+         coro.resume();
+         MCP_TEST_ASSERT( c == 111 );
+         coro.reset( [ & ]( control& ctrl ){
+            c = ctrl.yield_as< std::size_t >();
+         } );
+         coro.resume();
+         MCP_TEST_ASSERT( coro.state() == state::SLEEPING );
+         coro.resume( std::size_t( 7 ) );
+         MCP_TEST_ASSERT( c == 7 );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+      } {
+         struct foo {};
+         bool b = false;
+         coroutine coro( []( control& ){
+            throw foo();
+         } );
+         MCP_TEST_THROWS( coro.resume() );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+         coro.reset( [ & ](){
+            b = true;
+         } );
+         coro.resume();
+         MCP_TEST_ASSERT( b );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+      } {
+         std::size_t c = 0;
+         coroutine coro( [ & ](){
+            c = 1;
+         } );
+         MCP_TEST_ASSERT( coro.state() == state::STARTING );
+         coro.reset( [ & ](){
+            c = 2;
+         } );
+         MCP_TEST_ASSERT( coro.state() == state::STARTING );
+         coro.resume();
+         MCP_TEST_ASSERT( c == 2 );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+      } {
+         std::size_t c = 0;
+         coroutine coro( [ & ]( control& ctrl ){
+            cycle y( c );
+            ctrl.yield();
+         } );
+         const std::size_t used = coro.stack_used();
+         coro.resume();
+         MCP_TEST_ASSERT( coro.state() == state::SLEEPING );
+         MCP_TEST_ASSERT( coro.stack_used() != used );
+         MCP_TEST_THROWS( coro.reset( [](){} ) );
+         coro.abort();
+         MCP_TEST_ASSERT( c == 2 );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+         coro.reset( [ & ](){
+            c = 3;
+         } );
+         MCP_TEST_ASSERT( coro.state() == state::STARTING );
+         MCP_TEST_ASSERT( coro.stack_used() == used );
+         coro.resume();
+         MCP_TEST_ASSERT( c == 3 );
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+      } {
+         const auto p = std::make_shared< int >( 1 );
+         coroutine coro( [ p ](){} );
+         MCP_TEST_ASSERT( p.use_count() == 2 );
+         std::function< void() > f = [](){};
+         coro.reset( std::move( f ) );
+         MCP_TEST_ASSERT( p.use_count() == 1 );
+         std::function< void( control& ) > g = [ p ]( control& ){};
+         coro.reset( std::move( g ) );
+         MCP_TEST_ASSERT( p.use_count() == 2 );
+         coro.reset( [](){} );
+         MCP_TEST_ASSERT( p.use_count() == 1 );
+      } {
+         struct foo {};
+         coroutine coro( []( control& ctrl ){
+            MCP_TEST_ASSERT( ctrl.yield_as< int >( 1 ) == 2 );
+            throw foo();
+         } );
+         const auto r1 = coro.try_resume();
+         MCP_TEST_ASSERT( r1.state == state::SLEEPING );
+         MCP_TEST_ASSERT( std::any_cast< int >( r1.value ) == 1 );
+         MCP_TEST_ASSERT( !r1.exception );
+         const auto r2 = coro.try_resume( 2 );
+         MCP_TEST_ASSERT( r2.state == state::COMPLETED );
+         MCP_TEST_ASSERT( r2.exception );
+         MCP_TEST_THROWS( std::rethrow_exception( r2.exception ) );
+         const auto r3 = coro.try_resume();
+         MCP_TEST_ASSERT( r3.state == state::COMPLETED );
+         MCP_TEST_ASSERT( r3.exception );
+      } {
+         struct foo {};
+         struct bar
+         {
+            bar() = default;
+            bar( const bar& )
+            {
+               throw foo();
+            }
+         };
+         const bar b;
+         coroutine coro( []( control& ctrl ){
+            ctrl.yield();
+         } );
+         const auto r1 = coro.try_resume( b );
+         MCP_TEST_ASSERT( r1.state == state::STARTING );
+         MCP_TEST_ASSERT( r1.exception );
+         MCP_TEST_THROWS( std::rethrow_exception( r1.exception ) );
+         const auto r2 = coro.try_resume();
+         MCP_TEST_ASSERT( r2.state == state::SLEEPING );
+         MCP_TEST_ASSERT( !r2.exception );
+      } {
+         coroutine coro( [](){} );
+         coro.resume();
+         const auto r1 = coro.try_resume();
+         const auto r2 = coro.try_resume( 1 );
+         MCP_TEST_ASSERT( r1.state == state::COMPLETED );
+         MCP_TEST_ASSERT( r1.exception );
+         MCP_TEST_ASSERT( r1.exception == r2.exception );
+         MCP_TEST_THROWS( std::rethrow_exception( r1.exception ) );
+         coro.clear();
+         MCP_TEST_ASSERT( coro.state() == state::COMPLETED );
+         const auto r3 = coro.try_resume( 2 );
+         MCP_TEST_ASSERT( r3.state == state::COMPLETED );
+         MCP_TEST_ASSERT( !r3.value.has_value() );
+         MCP_TEST_ASSERT( r3.exception );
+         MCP_TEST_THROWS( std::rethrow_exception( r3.exception ) );
       }
    }
 